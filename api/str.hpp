@@ -305,7 +305,7 @@ namespace jule
         {
             if (this->_len != n)
                 return false;
-            return std::strncmp(reinterpret_cast<const char *>(this->begin()), s, this->_len) == 0;
+            return n == 0 || std::memcmp(this->begin(), s, n) == 0;
         }
 
         inline jule::U8 &operator[](const jule::Int &index) noexcept
@@ -392,10 +392,8 @@ namespace jule
         jule::Bool operator==(const jule::Str &str) const noexcept
         {
             return this->_len == str._len &&
-                   std::strncmp(
-                       reinterpret_cast<const char *>(this->begin()),
-                       reinterpret_cast<const char *>(str.begin()),
-                       this->_len) == 0;
+                   (this->_len == 0 ||
+                    std::memcmp(this->begin(), str.begin(), this->_len) == 0);
         }
 
         inline jule::Bool operator!=(const jule::Str &str) const noexcept
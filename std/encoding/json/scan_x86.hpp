@@ -0,0 +1,84 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_ENCODING_JSON_SCAN_X86_HPP
+#define __JULE_STD_ENCODING_JSON_SCAN_X86_HPP
+
+#include <immintrin.h>
+
+// The kernels classify the 64 bytes at p into the masks of m,
+// the bit i of a mask is set for the byte p[i]:
+//  m[0]: quotes
+//  m[1]: backslashes
+//  m[2]: structural characters, {}[]:,
+//  m[3]: whitespace
+//
+// The brackets and braces differ only in the 0x20 bit from each other,
+// so they are compared after setting the bit.
+
+__attribute__((target("avx2"))) inline void
+__jule_json_classify_avx2(const jule::U8 *p, jule::U64 *m) noexcept
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i case20 = _mm256_set1_epi8(0x20);
+    const __m256i open = _mm256_set1_epi8('{');
+    const __m256i close = _mm256_set1_epi8('}');
+    const __m256i colon = _mm256_set1_epi8(':');
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    m[0] = m[1] = m[2] = m[3] = 0;
+    for (int k = 0; k < 64; k += 32)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(p + k));
+        const __m256i lower = _mm256_or_si256(x, case20);
+        const __m256i op = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(lower, open), _mm256_cmpeq_epi8(lower, close)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(x, colon), _mm256_cmpeq_epi8(x, comma)));
+        const __m256i ws = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(x, space), _mm256_cmpeq_epi8(x, tab)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(x, lf), _mm256_cmpeq_epi8(x, cr)));
+        m[0] |= (jule::U64)(unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, quote)) << k;
+        m[1] |= (jule::U64)(unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, backslash)) << k;
+        m[2] |= (jule::U64)(unsigned)_mm256_movemask_epi8(op) << k;
+        m[3] |= (jule::U64)(unsigned)_mm256_movemask_epi8(ws) << k;
+    }
+}
+
+__attribute__((target("sse2"))) inline void
+__jule_json_classify_sse2(const jule::U8 *p, jule::U64 *m) noexcept
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i case20 = _mm_set1_epi8(0x20);
+    const __m128i open = _mm_set1_epi8('{');
+    const __m128i close = _mm_set1_epi8('}');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    m[0] = m[1] = m[2] = m[3] = 0;
+    for (int k = 0; k < 64; k += 16)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(p + k));
+        const __m128i lower = _mm_or_si128(x, case20);
+        const __m128i op = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(lower, open), _mm_cmpeq_epi8(lower, close)),
+            _mm_or_si128(_mm_cmpeq_epi8(x, colon), _mm_cmpeq_epi8(x, comma)));
+        const __m128i ws = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(x, space), _mm_cmpeq_epi8(x, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(x, lf), _mm_cmpeq_epi8(x, cr)));
+        m[0] |= (jule::U64)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, quote)) << k;
+        m[1] |= (jule::U64)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, backslash)) << k;
+        m[2] |= (jule::U64)(unsigned)_mm_movemask_epi8(op) << k;
+        m[3] |= (jule::U64)(unsigned)_mm_movemask_epi8(ws) << k;
+    }
+}
+
+#endif // ifndef __JULE_STD_ENCODING_JSON_SCAN_X86_HPP
@@ -0,0 +1,27 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_INTERNAL_BYTEORDER_NATIVE_HPP
+#define __JULE_STD_INTERNAL_BYTEORDER_NATIVE_HPP
+
+#include <string.h>
+
+// Loads by memcpy, so the pointer may be unaligned and the load does not
+// violate the strict aliasing rules. Compilers lower it to a single load.
+
+inline jule::U64 __jule_byteorder_load64(const void *p) noexcept
+{
+    jule::U64 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline jule::U32 __jule_byteorder_load32(const void *p) noexcept
+{
+    jule::U32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+#endif // ifndef __JULE_STD_INTERNAL_BYTEORDER_NATIVE_HPP
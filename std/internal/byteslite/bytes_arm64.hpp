@@ -0,0 +1,99 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_INTERNAL_BYTESLITE_BYTES_ARM64_HPP
+#define __JULE_STD_INTERNAL_BYTESLITE_BYTES_ARM64_HPP
+
+#include <arm_neon.h>
+
+// All kernels require n >= 16. The remainder shorter than a vector is
+// handled by an overlapping load of the first or the last 16 bytes,
+// instead of a scalar loop.
+//
+// NEON has no byte mask instruction, so a comparison result is narrowed
+// into a 64-bit mask which has 4 bits for each byte.
+
+inline uint64_t __jule_byteslite_mask_neon(uint8x16_t eq) noexcept
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+// Returns the last index of b in s, or -1 if not present.
+inline jule::Int
+__jule_byteslite_last_index_byte_neon(const jule::U8 *s, jule::Int n, jule::U8 b) noexcept
+{
+    const uint8x16_t v = vdupq_n_u8(b);
+    jule::Int i = n;
+    for (; i >= 16; i -= 16)
+    {
+        uint64_t m = __jule_byteslite_mask_neon(vceqq_u8(vld1q_u8(s + i - 16), v));
+        if (m)
+            return i - 16 + 15 - (__builtin_clzll(m) >> 2);
+    }
+    if (i > 0)
+    {
+        // The bytes at i and above are checked already and have no match.
+        uint64_t m = __jule_byteslite_mask_neon(vceqq_u8(vld1q_u8(s), v));
+        if (m)
+            return 15 - (__builtin_clzll(m) >> 2);
+    }
+    return -1;
+}
+
+// Returns the number of b in s.
+// Counts in the byte lanes, which are flushed before they overflow.
+inline jule::Int
+__jule_byteslite_count_byte_neon(const jule::U8 *s, jule::Int n, jule::U8 b) noexcept
+{
+    const uint8x16_t v = vdupq_n_u8(b);
+    jule::Int c = 0;
+    jule::Int i = 0;
+    while (n - i >= 16)
+    {
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (int k = 0; k < 255 && n - i >= 16; ++k, i += 16)
+        {
+            // Equal lanes are 0xFF, so subtraction increments them.
+            acc = vsubq_u8(acc, vceqq_u8(vld1q_u8(s + i), v));
+        }
+        c += vaddlvq_u8(acc);
+    }
+    if (i < n)
+    {
+        // Drop the bytes below i, they are counted already.
+        uint64_t m = __jule_byteslite_mask_neon(vceqq_u8(vld1q_u8(s + n - 16), v));
+        m >>= 4 * (16 - (n - i));
+        c += __builtin_popcountll(m) >> 2;
+    }
+    return c;
+}
+
+// Returns the first index i of s where s[i] == c0 and s[i+1] == c1,
+// or -1 if not present. Requires n >= 17.
+inline jule::Int
+__jule_byteslite_index_two_byte_neon(const jule::U8 *s, jule::Int n, jule::U8 c0, jule::U8 c1) noexcept
+{
+    const uint8x16_t v0 = vdupq_n_u8(c0);
+    const uint8x16_t v1 = vdupq_n_u8(c1);
+    jule::Int i = 0;
+    for (;;)
+    {
+        if (n - i < 17)
+        {
+            if (i + 1 >= n)
+                return -1;
+            // The pairs below i are checked already and have no match.
+            i = n - 17;
+        }
+        uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(s + i), v0), vceqq_u8(vld1q_u8(s + i + 1), v1));
+        uint64_t m = __jule_byteslite_mask_neon(eq);
+        if (m)
+            return i + (__builtin_ctzll(m) >> 2);
+        if (i == n - 17)
+            return -1;
+        i += 16;
+    }
+}
+
+#endif // ifndef __JULE_STD_INTERNAL_BYTESLITE_BYTES_ARM64_HPP
@@ -0,0 +1,101 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_INTERNAL_BYTESLITE_BYTES_X86_HPP
+#define __JULE_STD_INTERNAL_BYTESLITE_BYTES_X86_HPP
+
+#include <immintrin.h>
+
+// All kernels require n >= 32. The remainder shorter than a vector is
+// handled by an overlapping load of the first or the last 32 bytes,
+// instead of a scalar loop.
+
+// Returns the last index of b in s, or -1 if not present.
+__attribute__((target("avx2"))) inline jule::Int
+__jule_byteslite_last_index_byte_avx2(const jule::U8 *s, jule::Int n, jule::U8 b) noexcept
+{
+    const __m256i v = _mm256_set1_epi8((char)b);
+    jule::Int i = n;
+    for (; i >= 32; i -= 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(s + i - 32));
+        unsigned m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, v));
+        if (m)
+            return i - 32 + 31 - __builtin_clz(m);
+    }
+    if (i > 0)
+    {
+        // The bytes at i and above are checked already and have no match.
+        __m256i x = _mm256_loadu_si256((const __m256i *)s);
+        unsigned m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, v));
+        if (m)
+            return 31 - __builtin_clz(m);
+    }
+    return -1;
+}
+
+// Returns the number of b in s.
+// Counts in the byte lanes, which are flushed before they overflow.
+__attribute__((target("avx2"))) inline jule::Int
+__jule_byteslite_count_byte_avx2(const jule::U8 *s, jule::Int n, jule::U8 b) noexcept
+{
+    const __m256i v = _mm256_set1_epi8((char)b);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i sum = zero;
+    jule::Int i = 0;
+    while (n - i >= 32)
+    {
+        __m256i acc = zero;
+        for (int k = 0; k < 255 && n - i >= 32; ++k, i += 32)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(s + i));
+            // Equal lanes are -1, so subtraction increments them.
+            acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(x, v));
+        }
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(acc, zero));
+    }
+    jule::U64 lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, sum);
+    jule::Int c = (jule::Int)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    if (i < n)
+    {
+        // Drop the bytes below i, they are counted already.
+        __m256i x = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+        unsigned m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, v));
+        m >>= 32 - (n - i);
+        c += __builtin_popcount(m);
+    }
+    return c;
+}
+
+// Returns the first index i of s where s[i] == c0 and s[i+1] == c1,
+// or -1 if not present. Requires n >= 33.
+__attribute__((target("avx2"))) inline jule::Int
+__jule_byteslite_index_two_byte_avx2(const jule::U8 *s, jule::Int n, jule::U8 c0, jule::U8 c1) noexcept
+{
+    const __m256i v0 = _mm256_set1_epi8((char)c0);
+    const __m256i v1 = _mm256_set1_epi8((char)c1);
+    jule::Int i = 0;
+    for (;;)
+    {
+        if (n - i < 33)
+        {
+            if (i + 1 >= n)
+                return -1;
+            // The pairs below i are checked already and have no match.
+            i = n - 33;
+        }
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i x1 = _mm256_loadu_si256((const __m256i *)(s + i + 1));
+        unsigned m = (unsigned)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(x0, v0), _mm256_cmpeq_epi8(x1, v1)));
+        if (m)
+            return i + __builtin_ctz(m);
+        if (i == n - 33)
+            return -1;
+        i += 32;
+    }
+}
+
+#endif // ifndef __JULE_STD_INTERNAL_BYTESLITE_BYTES_X86_HPP
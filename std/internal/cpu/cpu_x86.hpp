@@ -0,0 +1,25 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_INTERNAL_CPU_CPU_X86_HPP
+#define __JULE_STD_INTERNAL_CPU_CPU_X86_HPP
+
+#include <cpuid.h>
+
+inline void __jule_cpuid(jule::U32 leaf, jule::U32 subleaf,
+                         jule::U32 *eax, jule::U32 *ebx,
+                         jule::U32 *ecx, jule::U32 *edx) noexcept
+{
+    __cpuid_count(leaf, subleaf, *eax, *ebx, *ecx, *edx);
+}
+
+// Encoded as bytes for assemblers without the XSAVE extension.
+inline void __jule_xgetbv(jule::U32 *eax, jule::U32 *edx) noexcept
+{
+    __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0"
+                         : "=a"(*eax), "=d"(*edx)
+                         : "c"(0));
+}
+
+#endif // ifndef __JULE_STD_INTERNAL_CPU_CPU_X86_HPP
@@ -0,0 +1,239 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_INTERNAL_POLL_URING_LINUX_HPP
+#define __JULE_STD_INTERNAL_POLL_URING_LINUX_HPP
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+// Minimal io_uring implementation without liburing.
+// The submission queue is not safe for concurrent use,
+// and the completion queue is not safe for concurrent use.
+// But submission and completion may be used concurrently by different threads.
+typedef struct
+{
+    int fd;
+
+    // Submission queue.
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    struct io_uring_sqe *sqes;
+    unsigned sq_entries;
+    unsigned sqe_tail; // Local tail of the prepared but not published entries.
+    unsigned to_submit;
+
+    // Completion queue.
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+
+    void *sq_ptr;
+    size_t sq_size;
+    void *cq_ptr;
+    size_t cq_size;
+    size_t sqes_size;
+} __jule_uring;
+
+inline void __jule_uring_unmap(__jule_uring *r) noexcept
+{
+    if (r->sqes && r->sqes != MAP_FAILED)
+        munmap(r->sqes, r->sqes_size);
+    if (r->cq_ptr && r->cq_ptr != MAP_FAILED && r->cq_ptr != r->sq_ptr)
+        munmap(r->cq_ptr, r->cq_size);
+    if (r->sq_ptr && r->sq_ptr != MAP_FAILED)
+        munmap(r->sq_ptr, r->sq_size);
+}
+
+// Sets up a new ring with entries.
+// Returns NULL if error occurred, errno is set.
+inline __jule_uring *__jule_uring_setup(jule::U32 entries) noexcept
+{
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    const int fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+    if (fd < 0)
+        return NULL;
+    __jule_uring *r = (__jule_uring *)calloc(1, sizeof(__jule_uring));
+    if (!r)
+    {
+        close(fd);
+        errno = ENOMEM;
+        return NULL;
+    }
+    r->fd = fd;
+    r->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    r->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (r->cq_size > r->sq_size)
+            r->sq_size = r->cq_size;
+        r->cq_size = r->sq_size;
+    }
+    r->sq_ptr = mmap(0, r->sq_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (r->sq_ptr == MAP_FAILED)
+        goto fail;
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        r->cq_ptr = r->sq_ptr;
+    else
+    {
+        r->cq_ptr = mmap(0, r->cq_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (r->cq_ptr == MAP_FAILED)
+            goto fail;
+    }
+    r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = (struct io_uring_sqe *)mmap(0, r->sqes_size, PROT_READ | PROT_WRITE,
+                                          MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (r->sqes == MAP_FAILED)
+        goto fail;
+
+    r->sq_head = (unsigned *)((char *)r->sq_ptr + p.sq_off.head);
+    r->sq_tail = (unsigned *)((char *)r->sq_ptr + p.sq_off.tail);
+    r->sq_mask = (unsigned *)((char *)r->sq_ptr + p.sq_off.ring_mask);
+    r->sq_array = (unsigned *)((char *)r->sq_ptr + p.sq_off.array);
+    r->sq_entries = p.sq_entries;
+    r->sqe_tail = *r->sq_tail;
+    r->cq_head = (unsigned *)((char *)r->cq_ptr + p.cq_off.head);
+    r->cq_tail = (unsigned *)((char *)r->cq_ptr + p.cq_off.tail);
+    r->cq_mask = (unsigned *)((char *)r->cq_ptr + p.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe *)((char *)r->cq_ptr + p.cq_off.cqes);
+    return r;
+fail:
+    const int err = errno;
+    __jule_uring_unmap(r);
+    close(fd);
+    free(r);
+    errno = err;
+    return NULL;
+}
+
+// Releases the ring.
+inline void __jule_uring_close(__jule_uring *r) noexcept
+{
+    __jule_uring_unmap(r);
+    close(r->fd);
+    free(r);
+}
+
+// Prepares a new submission queue entry.
+// Returns false if the submission queue is full.
+// The entry is not published until submit.
+inline jule::Bool __jule_uring_prep(__jule_uring *r, jule::U8 opcode, jule::Int fd,
+                                    jule::U64 addr, jule::U32 len, jule::U64 off,
+                                    jule::U32 opflags, jule::U8 flags, jule::I32 buf_index,
+                                    jule::U64 user_data) noexcept
+{
+    const unsigned head = __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE);
+    if (r->sqe_tail - head >= r->sq_entries)
+        return false;
+    const unsigned index = r->sqe_tail & *r->sq_mask;
+    struct io_uring_sqe *sqe = &r->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->flags = flags;
+    sqe->fd = (int)fd;
+    sqe->addr = addr;
+    sqe->len = len;
+    sqe->off = off;
+    sqe->rw_flags = (__kernel_rwf_t)opflags;
+    if (buf_index >= 0)
+        sqe->buf_index = (__u16)buf_index;
+    sqe->user_data = user_data;
+    r->sq_array[index] = index;
+    r->sqe_tail++;
+    r->to_submit++;
+    return true;
+}
+
+// Publishes prepared entries and submits them to the kernel.
+// Waits for at least wait_nr completions.
+// Returns the number of submitted entries, or -1 if error occurred.
+inline jule::Int __jule_uring_submit(__jule_uring *r, jule::U32 wait_nr) noexcept
+{
+    __atomic_store_n(r->sq_tail, r->sqe_tail, __ATOMIC_RELEASE);
+    const unsigned to_submit = r->to_submit;
+    const unsigned flags = wait_nr ? IORING_ENTER_GETEVENTS : 0;
+    int ret;
+    do
+        ret = (int)syscall(__NR_io_uring_enter, r->fd, to_submit, wait_nr, flags, NULL, 0);
+    while (ret == -1 && errno == EINTR);
+    if (ret < 0)
+        return -1;
+    r->to_submit -= (unsigned)ret;
+    return ret;
+}
+
+// Returns the number of published but not submitted entries.
+inline jule::U32 __jule_uring_unsubmitted(__jule_uring *r) noexcept
+{
+    return r->to_submit;
+}
+
+// Waits for at least one completion without submission.
+// Returns -1 if error occurred.
+inline jule::Int __jule_uring_wait(__jule_uring *r) noexcept
+{
+    int ret;
+    do
+        ret = (int)syscall(__NR_io_uring_enter, r->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+    while (ret == -1 && errno == EINTR);
+    return ret < 0 ? -1 : 0;
+}
+
+// Pops a completion queue entry if exist.
+// Returns false if there is no completion.
+inline jule::Bool __jule_uring_peek(__jule_uring *r, jule::U64 *user_data,
+                                    jule::I32 *res, jule::U32 *flags) noexcept
+{
+    const unsigned head = *r->cq_head;
+    if (head == __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE))
+        return false;
+    const struct io_uring_cqe *cqe = &r->cqes[head & *r->cq_mask];
+    *user_data = cqe->user_data;
+    *res = cqe->res;
+    *flags = cqe->flags;
+    __atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Registers buffers for the fixed read and write operations.
+// Returns -1 if error occurred.
+inline jule::Int __jule_uring_register_buffers(__jule_uring *r, const void *iovs, jule::U32 n) noexcept
+{
+    return (int)syscall(__NR_io_uring_register, r->fd, IORING_REGISTER_BUFFERS, iovs, n);
+}
+
+// Unregisters buffers.
+// Returns -1 if error occurred.
+inline jule::Int __jule_uring_unregister_buffers(__jule_uring *r) noexcept
+{
+    return (int)syscall(__NR_io_uring_register, r->fd, IORING_UNREGISTER_BUFFERS, NULL, 0);
+}
+
+// Registers file descriptors for the fixed file operations.
+// Returns -1 if error occurred.
+inline jule::Int __jule_uring_register_files(__jule_uring *r, const jule::I32 *fds, jule::U32 n) noexcept
+{
+    return (int)syscall(__NR_io_uring_register, r->fd, IORING_REGISTER_FILES, fds, n);
+}
+
+// Unregisters file descriptors.
+// Returns -1 if error occurred.
+inline jule::Int __jule_uring_unregister_files(__jule_uring *r) noexcept
+{
+    return (int)syscall(__NR_io_uring_register, r->fd, IORING_UNREGISTER_FILES, NULL, 0);
+}
+
+#endif // ifndef __JULE_STD_INTERNAL_POLL_URING_LINUX_HPP
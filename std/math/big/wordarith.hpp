@@ -0,0 +1,178 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_MATH_BIG_WORDARITH_HPP
+#define __JULE_STD_MATH_BIG_WORDARITH_HPP
+
+// Vector kernels of the 64-bit words.
+// The carry chains use the _addcarry_u64 and _subborrow_u64 intrinsics
+// on the amd64, which are compiled to the adc and sbb instructions.
+// The other architectures use 128-bit integers, which are compiled
+// to the adds/adcs chains on the arm64.
+
+#include <stdint.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif // if defined(__x86_64__)
+
+typedef unsigned long long __jule_big_u64;
+typedef unsigned __int128 __jule_big_u128;
+
+#if defined(__x86_64__)
+#define __JULE_BIG_ADDC(c, x, y, z) (c) = _addcarry_u64((c), (x), (y), (z))
+#define __JULE_BIG_SUBB(c, x, y, z) (c) = _subborrow_u64((c), (x), (y), (z))
+#else
+#define __JULE_BIG_ADDC(c, x, y, z)                                              \
+    {                                                                            \
+        __jule_big_u128 __t = (__jule_big_u128)(x) + (y) + (c);                  \
+        *(z) = (__jule_big_u64)__t;                                              \
+        (c) = (unsigned char)(__t >> 64);                                        \
+    }
+#define __JULE_BIG_SUBB(c, x, y, z)                                              \
+    {                                                                            \
+        __jule_big_u128 __t = (__jule_big_u128)(x) - (y) - (c);                  \
+        *(z) = (__jule_big_u64)__t;                                              \
+        (c) = (unsigned char)(__t >> 127);                                       \
+    }
+#endif // if defined(__x86_64__)
+
+// z = x + y for n words, returns the carry.
+inline jule::Uint __jule_big_addVV(jule::Uint *z, const jule::Uint *x, const jule::Uint *y, jule::Int n) noexcept
+{
+    unsigned char c = 0;
+    __jule_big_u64 t0, t1, t2, t3;
+    jule::Int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __JULE_BIG_ADDC(c, x[i], y[i], &t0);
+        __JULE_BIG_ADDC(c, x[i + 1], y[i + 1], &t1);
+        __JULE_BIG_ADDC(c, x[i + 2], y[i + 2], &t2);
+        __JULE_BIG_ADDC(c, x[i + 3], y[i + 3], &t3);
+        z[i] = t0;
+        z[i + 1] = t1;
+        z[i + 2] = t2;
+        z[i + 3] = t3;
+    }
+    for (; i < n; ++i)
+    {
+        __JULE_BIG_ADDC(c, x[i], y[i], &t0);
+        z[i] = t0;
+    }
+    return c;
+}
+
+// z = x - y for n words, returns the borrow.
+inline jule::Uint __jule_big_subVV(jule::Uint *z, const jule::Uint *x, const jule::Uint *y, jule::Int n) noexcept
+{
+    unsigned char c = 0;
+    __jule_big_u64 t0, t1, t2, t3;
+    jule::Int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __JULE_BIG_SUBB(c, x[i], y[i], &t0);
+        __JULE_BIG_SUBB(c, x[i + 1], y[i + 1], &t1);
+        __JULE_BIG_SUBB(c, x[i + 2], y[i + 2], &t2);
+        __JULE_BIG_SUBB(c, x[i + 3], y[i + 3], &t3);
+        z[i] = t0;
+        z[i + 1] = t1;
+        z[i + 2] = t2;
+        z[i + 3] = t3;
+    }
+    for (; i < n; ++i)
+    {
+        __JULE_BIG_SUBB(c, x[i], y[i], &t0);
+        z[i] = t0;
+    }
+    return c;
+}
+
+// z = x + y for n words where y is a single word, returns the carry.
+// Copies the rest of x when the carry is zero.
+inline jule::Uint __jule_big_addVW(jule::Uint *z, const jule::Uint *x, jule::Uint y, jule::Int n) noexcept
+{
+    unsigned char c = 0;
+    __jule_big_u64 t;
+    jule::Int i = 0;
+    if (n > 0)
+    {
+        __JULE_BIG_ADDC(c, x[0], y, &t);
+        z[0] = t;
+        i = 1;
+    }
+    for (; i < n && c != 0; ++i)
+    {
+        __JULE_BIG_ADDC(c, x[i], 0, &t);
+        z[i] = t;
+    }
+    if (z != x)
+        for (; i < n; ++i)
+            z[i] = x[i];
+    return c;
+}
+
+// z = x - y for n words where y is a single word, returns the borrow.
+// Copies the rest of x when the borrow is zero.
+inline jule::Uint __jule_big_subVW(jule::Uint *z, const jule::Uint *x, jule::Uint y, jule::Int n) noexcept
+{
+    unsigned char c = 0;
+    __jule_big_u64 t;
+    jule::Int i = 0;
+    if (n > 0)
+    {
+        __JULE_BIG_SUBB(c, x[0], y, &t);
+        z[0] = t;
+        i = 1;
+    }
+    for (; i < n && c != 0; ++i)
+    {
+        __JULE_BIG_SUBB(c, x[i], 0, &t);
+        z[i] = t;
+    }
+    if (z != x)
+        for (; i < n; ++i)
+            z[i] = x[i];
+    return c;
+}
+
+// z = x*y + r for n words, returns the high word.
+inline jule::Uint __jule_big_mulAddVWW(jule::Uint *z, const jule::Uint *x, jule::Uint y, jule::Uint r, jule::Int n) noexcept
+{
+    __jule_big_u64 c = r;
+    for (jule::Int i = 0; i < n; ++i)
+    {
+        __jule_big_u128 t = (__jule_big_u128)x[i] * y + c;
+        z[i] = (__jule_big_u64)t;
+        c = (__jule_big_u64)(t >> 64);
+    }
+    return c;
+}
+
+// z += x*y for n words, returns the high word.
+// The sum x[i]*y + z[i] + c fits into 128 bits.
+inline jule::Uint __jule_big_addMulVVW(jule::Uint *z, const jule::Uint *x, jule::Uint y, jule::Int n) noexcept
+{
+    __jule_big_u64 c = 0;
+    jule::Int i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        __jule_big_u128 t0 = (__jule_big_u128)x[i] * y + z[i] + c;
+        __jule_big_u128 t1 = (__jule_big_u128)x[i + 1] * y + z[i + 1] + (__jule_big_u64)(t0 >> 64);
+        z[i] = (__jule_big_u64)t0;
+        z[i + 1] = (__jule_big_u64)t1;
+        c = (__jule_big_u64)(t1 >> 64);
+    }
+    for (; i < n; ++i)
+    {
+        __jule_big_u128 t = (__jule_big_u128)x[i] * y + z[i] + c;
+        z[i] = (__jule_big_u64)t;
+        c = (__jule_big_u64)(t >> 64);
+    }
+    return c;
+}
+
+#undef __JULE_BIG_ADDC
+#undef __JULE_BIG_SUBB
+
+#endif // ifndef __JULE_STD_MATH_BIG_WORDARITH_HPP
@@ -0,0 +1,214 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_NET_UDP_BATCH_LINUX_HPP
+#define __JULE_STD_NET_UDP_BATCH_LINUX_HPP
+
+#include <errno.h>
+#include <string.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif // ifndef SOL_UDP
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif // ifndef UDP_SEGMENT
+
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif // ifndef UDP_GRO
+
+// Maximum number of the messages for a single system call.
+#define __JULE_UDP_BATCH_MAX 64
+
+// Message of the batch operations.
+// Address is stored in host byte order for port, and network byte order for ip.
+// Family is zero if message has no address.
+typedef struct
+{
+    void *buf;
+    jule::Uint len;
+    jule::Int n;
+    jule::Int segsize;
+    jule::Int family;
+    jule::Int port;
+    jule::U8 addr[16];
+} __jule_udp_msg;
+
+inline void __jule_udp_decode_addr(const struct sockaddr_storage *ss, __jule_udp_msg *m) noexcept
+{
+    if (ss->ss_family == AF_INET)
+    {
+        const struct sockaddr_in *sa = (const struct sockaddr_in *)ss;
+        m->family = AF_INET;
+        m->port = ntohs(sa->sin_port);
+        memcpy(m->addr, &sa->sin_addr, 4);
+    }
+    else if (ss->ss_family == AF_INET6)
+    {
+        const struct sockaddr_in6 *sa = (const struct sockaddr_in6 *)ss;
+        m->family = AF_INET6;
+        m->port = ntohs(sa->sin6_port);
+        memcpy(m->addr, &sa->sin6_addr, 16);
+    }
+    else
+        m->family = 0;
+}
+
+// Encodes address of the message into ss and returns its length.
+// IPv6 sockets cannot send to the AF_INET addresses, so if v6 is true,
+// IPv4 addresses are encoded as v4-mapped IPv6 addresses (::ffff:a.b.c.d).
+inline socklen_t __jule_udp_encode_addr(const __jule_udp_msg *m, struct sockaddr_storage *ss, jule::Bool v6) noexcept
+{
+    memset(ss, 0, sizeof(*ss));
+    if (m->family == AF_INET && v6)
+    {
+        struct sockaddr_in6 *sa = (struct sockaddr_in6 *)ss;
+        sa->sin6_family = AF_INET6;
+        sa->sin6_port = htons((uint16_t)m->port);
+        sa->sin6_addr.s6_addr[10] = 0xff;
+        sa->sin6_addr.s6_addr[11] = 0xff;
+        memcpy(&sa->sin6_addr.s6_addr[12], m->addr, 4);
+        return sizeof(struct sockaddr_in6);
+    }
+    if (m->family == AF_INET)
+    {
+        struct sockaddr_in *sa = (struct sockaddr_in *)ss;
+        sa->sin_family = AF_INET;
+        sa->sin_port = htons((uint16_t)m->port);
+        memcpy(&sa->sin_addr, m->addr, 4);
+        return sizeof(struct sockaddr_in);
+    }
+    if (m->family == AF_INET6)
+    {
+        struct sockaddr_in6 *sa = (struct sockaddr_in6 *)ss;
+        sa->sin6_family = AF_INET6;
+        sa->sin6_port = htons((uint16_t)m->port);
+        memcpy(&sa->sin6_addr, m->addr, 16);
+        return sizeof(struct sockaddr_in6);
+    }
+    return 0;
+}
+
+// Receives up to vlen messages with a single recvmmsg call.
+// Blocks until at least one message is received.
+// Returns the number of received messages, or -1 if error occurred.
+// The segsize field is set by the GRO segment size if exist, zero otherwise.
+// Source address of the last received message is copied into last,
+// if it has the same length as lastlen, like recvfrom does for a single message.
+inline jule::Int __jule_udp_recvmmsg(jule::Int fd, __jule_udp_msg *msgs, jule::Int vlen,
+                                     void *last, jule::Uint lastlen) noexcept
+{
+    if (vlen > __JULE_UDP_BATCH_MAX)
+        vlen = __JULE_UDP_BATCH_MAX;
+    struct mmsghdr hdrs[__JULE_UDP_BATCH_MAX];
+    struct iovec iovs[__JULE_UDP_BATCH_MAX];
+    struct sockaddr_storage addrs[__JULE_UDP_BATCH_MAX];
+    char ctrls[__JULE_UDP_BATCH_MAX][CMSG_SPACE(sizeof(int))];
+    memset(hdrs, 0, sizeof(struct mmsghdr) * vlen);
+    for (jule::Int i = 0; i < vlen; ++i)
+    {
+        iovs[i].iov_base = msgs[i].buf;
+        iovs[i].iov_len = msgs[i].len;
+        hdrs[i].msg_hdr.msg_iov = &iovs[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+        hdrs[i].msg_hdr.msg_name = &addrs[i];
+        hdrs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+        hdrs[i].msg_hdr.msg_control = ctrls[i];
+        hdrs[i].msg_hdr.msg_controllen = sizeof(ctrls[i]);
+    }
+    int r;
+    do
+        r = recvmmsg(fd, hdrs, vlen, MSG_WAITFORONE, NULL);
+    while (r == -1 && errno == EINTR);
+    if (r == -1)
+        return -1;
+    for (int i = 0; i < r; ++i)
+    {
+        msgs[i].n = hdrs[i].msg_len;
+        msgs[i].segsize = 0;
+        __jule_udp_decode_addr(&addrs[i], &msgs[i]);
+        for (struct cmsghdr *c = CMSG_FIRSTHDR(&hdrs[i].msg_hdr); c; c = CMSG_NXTHDR(&hdrs[i].msg_hdr, c))
+        {
+            if (c->cmsg_level == SOL_UDP && c->cmsg_type == UDP_GRO)
+            {
+                int segsize;
+                memcpy(&segsize, CMSG_DATA(c), sizeof(segsize));
+                msgs[i].segsize = segsize;
+            }
+        }
+    }
+    if (r > 0 && hdrs[r - 1].msg_hdr.msg_namelen == lastlen)
+        memcpy(last, &addrs[r - 1], lastlen);
+    return r;
+}
+
+// Sends up to vlen messages with a single sendmmsg call.
+// Messages without address are sent to the default address def, if not NULL.
+// Messages with positive segsize are segmented by the kernel (UDP GSO).
+// The v6 reports whether fd is an IPv6 socket.
+// Returns the number of sent messages, or -1 if error occurred.
+inline jule::Int __jule_udp_sendmmsg(jule::Int fd, __jule_udp_msg *msgs, jule::Int vlen,
+                                     const void *def, jule::Uint deflen, jule::Bool v6) noexcept
+{
+    if (vlen > __JULE_UDP_BATCH_MAX)
+        vlen = __JULE_UDP_BATCH_MAX;
+    struct mmsghdr hdrs[__JULE_UDP_BATCH_MAX];
+    struct iovec iovs[__JULE_UDP_BATCH_MAX];
+    struct sockaddr_storage addrs[__JULE_UDP_BATCH_MAX];
+    char ctrls[__JULE_UDP_BATCH_MAX][CMSG_SPACE(sizeof(uint16_t))];
+    memset(hdrs, 0, sizeof(struct mmsghdr) * vlen);
+    for (jule::Int i = 0; i < vlen; ++i)
+    {
+        iovs[i].iov_base = msgs[i].buf;
+        iovs[i].iov_len = msgs[i].len;
+        hdrs[i].msg_hdr.msg_iov = &iovs[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+        const socklen_t len = __jule_udp_encode_addr(&msgs[i], &addrs[i], v6);
+        if (len)
+        {
+            hdrs[i].msg_hdr.msg_name = &addrs[i];
+            hdrs[i].msg_hdr.msg_namelen = len;
+        }
+        else if (def)
+        {
+            hdrs[i].msg_hdr.msg_name = (void *)def;
+            hdrs[i].msg_hdr.msg_namelen = deflen;
+        }
+        if (msgs[i].segsize > 0)
+        {
+            memset(ctrls[i], 0, sizeof(ctrls[i]));
+            hdrs[i].msg_hdr.msg_control = ctrls[i];
+            hdrs[i].msg_hdr.msg_controllen = sizeof(ctrls[i]);
+            struct cmsghdr *c = CMSG_FIRSTHDR(&hdrs[i].msg_hdr);
+            c->cmsg_level = SOL_UDP;
+            c->cmsg_type = UDP_SEGMENT;
+            c->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+            const uint16_t segsize = (uint16_t)msgs[i].segsize;
+            memcpy(CMSG_DATA(c), &segsize, sizeof(segsize));
+        }
+    }
+    int r;
+    do
+        r = sendmmsg(fd, hdrs, vlen, 0);
+    while (r == -1 && errno == EINTR);
+    if (r == -1)
+        return -1;
+    for (int i = 0; i < r; ++i)
+        msgs[i].n = hdrs[i].msg_len;
+    return r;
+}
+
+// Enables or disables UDP GRO for the socket.
+// Returns -1 if error occurred.
+inline jule::Int __jule_udp_set_gro(jule::Int fd, jule::Bool enable) noexcept
+{
+    int v = enable ? 1 : 0;
+    return setsockopt(fd, SOL_UDP, UDP_GRO, &v, sizeof(v));
+}
+
+#endif // ifndef __JULE_STD_NET_UDP_BATCH_LINUX_HPP
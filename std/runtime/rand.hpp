@@ -0,0 +1,18 @@
+// Copyright 2025 The Jule Programming Language.
+// Use of this source code is governed by a BSD 3-Clause
+// license that can be found in the LICENSE file.
+
+#ifndef __JULE_STD_RUNTIME_RAND_HPP
+#define __JULE_STD_RUNTIME_RAND_HPP
+
+// Returns the pointer to the random state of the current thread.
+// Each thread has its own state, so the generator needs no locks and
+// the threads do not share the cache lines of the states.
+// The state is zero until it is seeded by the runtime.
+inline jule::U64 *__jule_rand_state(void) noexcept
+{
+    static thread_local jule::U64 state = 0;
+    return &state;
+}
+
+#endif // ifndef __JULE_STD_RUNTIME_RAND_HPP